@@ -0,0 +1,24 @@
+#!/bin/sh
+#
+# calibrate.sh
+# Purpose: Calibrates the verification cost model. Measures BLAKE3 and memcmp
+#          throughput and the cached read cost over the synthetic corpus, and
+#          writes the model file that --cost-model reads. Device parameters
+#          (seek and read cost of SSDs and rotating disks) keep their defaults
+#          and may be edited in the file.
+#
+# Usage: bench/calibrate.sh BINARY MODEL_FILE [CORPUS_DIR]
+set -eu
+
+if [ $# -lt 2 ]; then
+    echo "Usage: $0 BINARY MODEL_FILE [CORPUS_DIR]" >&2
+    exit 1
+fi
+
+BIN=$1
+MODEL=$2
+CORPUS=${3:-build/bench-corpus}
+BENCH_DIR=$(dirname "$0")
+
+"$BENCH_DIR/corpus.sh" "$CORPUS"
+"$BIN" -r --calibrate "$MODEL" "$CORPUS"
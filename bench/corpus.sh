@@ -0,0 +1,83 @@
+#!/bin/sh
+#
+# corpus.sh
+# Purpose: Generates the deterministic synthetic benchmark corpus used by the
+#          end-to-end benchmark (bench/run.sh) and the PGO training run
+#          (bench/train.sh).
+#
+# Usage: bench/corpus.sh OUTPUT_DIR
+#
+# The content generator is a Park-Miller LCG evaluated in awk, so every awk
+# implementation produces byte-identical files and the profile recorded for
+# `make MODE=pgo` is reproducible. The corpus mixes the cases the duplicate
+# finder has to handle: unique sizes, exact copies, and same-size files that
+# only differ in their last byte (worst case for the content comparison).
+set -eu
+
+if [ $# -ne 1 ]; then
+    echo "Usage: $0 OUTPUT_DIR" >&2
+    exit 1
+fi
+
+OUT=$1
+STAMP="$OUT/.corpus-v1"
+
+if [ -f "$STAMP" ]; then
+    exit 0
+fi
+
+rm -rf "$OUT"
+mkdir -p "$OUT"
+
+# gen_file SEED SIZE PATH - writes SIZE bytes of hex text derived from SEED.
+gen_file() {
+    awk -v seed="$1" -v size="$2" 'BEGIN {
+        x = seed % 2147483647; if (x <= 0) x = 1;
+        n = 0;
+        while (n < size) {
+            x = (x * 16807) % 2147483647; a = x;
+            x = (x * 16807) % 2147483647; b = x;
+            s = sprintf("%08x%08x\n", a, b);
+            if (n + length(s) > size) s = substr(s, 1, size - n);
+            printf "%s", s;
+            n += length(s);
+        }
+    }' > "$3"
+}
+
+i=0
+for d in 0 1 2 3 4 5 6 7; do
+    mkdir -p "$OUT/d$d/sub" "$OUT/d$d/sub/deep"
+done
+
+# Unique files of assorted sizes (eliminated by size grouping alone).
+while [ $i -lt 96 ]; do
+    d=$((i % 8))
+    gen_file $((1000 + i)) $((3000 + i * 517)) "$OUT/d$d/unique_$i.txt"
+    i=$((i + 1))
+done
+
+# Exact duplicates: originals in d0..d3, copies scattered across the tree.
+i=0
+while [ $i -lt 24 ]; do
+    size=$((16384 + (i % 6) * 262144))
+    gen_file $((5000 + i)) $size "$OUT/d$((i % 4))/orig_$i.txt"
+    cp "$OUT/d$((i % 4))/orig_$i.txt" "$OUT/d$((4 + i % 4))/sub/copy_$i.txt"
+    if [ $((i % 3)) -eq 0 ]; then
+        cp "$OUT/d$((i % 4))/orig_$i.txt" "$OUT/d$((i % 8))/sub/deep/copy2_$i.txt"
+    fi
+    i=$((i + 1))
+done
+
+# Same-size near duplicates that differ only in the final byte.
+i=0
+while [ $i -lt 16 ]; do
+    size=$((1048576 + (i % 4) * 65536))
+    gen_file $((9000 + i)) $((size - 1)) "$OUT/d$((i % 8))/near_a_$i.txt"
+    cp "$OUT/d$((i % 8))/near_a_$i.txt" "$OUT/d$(((i + 3) % 8))/sub/near_b_$i.txt"
+    printf 'A' >> "$OUT/d$((i % 8))/near_a_$i.txt"
+    printf 'B' >> "$OUT/d$(((i + 3) % 8))/sub/near_b_$i.txt"
+    i=$((i + 1))
+done
+
+touch "$STAMP"
@@ -0,0 +1,46 @@
+#!/bin/sh
+#
+# run.sh
+# Purpose: End-to-end benchmark. Times a full recursive scan of the synthetic
+#          corpus and prints the best and median wall-clock time in ms, and
+#          the peak resident memory reported by --stats. POSIX date has
+#          no sub-second format, so the runs are timed by python3's
+#          monotonic clock.
+#
+# Usage: bench/run.sh BINARY [ITERATIONS] [CORPUS_DIR] [-- EXTRA_ARGS...]
+set -eu
+
+if [ $# -lt 1 ]; then
+    echo "Usage: $0 BINARY [ITERATIONS] [CORPUS_DIR] [-- EXTRA_ARGS...]" >&2
+    exit 1
+fi
+
+BIN=$1
+ITERATIONS=${2:-5}
+CORPUS=${3:-build/bench-corpus}
+BENCH_DIR=$(dirname "$0")
+shift $(($# < 3 ? $# : 3))
+if [ "${1:-}" = "--" ]; then
+    shift
+fi
+
+"$BENCH_DIR/corpus.sh" "$CORPUS"
+
+# Warm the page cache so the runs measure CPU work, not the first cold read.
+# The warm-up also reports the peak memory.
+PEAK=$("$BIN" -r --stats "$@" "$CORPUS" 2>&1 > /dev/null | sed -n 's/^Memory: \([0-9]*\) KB.*/\1/p')
+
+TIMES=""
+n=0
+while [ $n -lt "$ITERATIONS" ]; do
+    ms=$(python3 -c 'import subprocess, sys, time
+start = time.monotonic()
+subprocess.run(sys.argv[1:], stdout=subprocess.DEVNULL, check=True)
+print(int((time.monotonic() - start) * 1000))' "$BIN" -r "$@" "$CORPUS")
+    TIMES="$TIMES $ms"
+    n=$((n + 1))
+done
+
+echo "$TIMES" | tr ' ' '\n' | sed '/^$/d' | sort -n | awk -v bin="$BIN" -v peak="${PEAK:-?}" '
+    { t[NR] = $1 }
+    END { printf "%s: best %d ms, median %d ms (%d runs), peak %s KB\n", bin, t[1], t[int((NR + 1) / 2)], NR, peak }'
@@ -0,0 +1,24 @@
+#!/bin/sh
+#
+# train.sh
+# Purpose: Training workload for `make MODE=pgo`. Runs the instrumented binary
+#          over the synthetic corpus with the option mixes we care about so the
+#          recorded profile covers traversal, MIME filtering and comparison.
+#
+# Usage: bench/train.sh BINARY CORPUS_DIR
+set -eu
+
+if [ $# -ne 2 ]; then
+    echo "Usage: $0 BINARY CORPUS_DIR" >&2
+    exit 1
+fi
+
+BIN=$1
+CORPUS=$2
+BENCH_DIR=$(dirname "$0")
+
+"$BENCH_DIR/corpus.sh" "$CORPUS"
+
+"$BIN" -r "$CORPUS" > /dev/null
+"$BIN" -r -m text/plain "$CORPUS" > /dev/null
+"$BIN" "$CORPUS/d0" "$CORPUS/d4/sub" > /dev/null